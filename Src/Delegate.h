@@ -2,8 +2,10 @@
 
 
 #include <vector>
+#include <unordered_map>
 #include <type_traits>
 #include <tuple>
+#include <algorithm>
 
 
 
@@ -25,6 +27,22 @@
 #endif
 
 
+// Declare common signatures once in a shared header with DELEGATE_EXTERN_TEMPLATE(void(int))
+// and instantiate them in exactly one translation unit with DELEGATE_INSTANTIATE_TEMPLATE(void(int)).
+// Members are defined in the class body so they are implicitly inline, and extern template doesn't stop the compiler
+// from instantiating inline functions it wants to inline. The gain depends on the compiler and optimisation level,
+// it mostly applies to -O0/Debug builds (see Script/CompileTimeBenchmark.py)
+#define DELEGATE_EXTERN_TEMPLATE(...)                     \
+    extern template class IDelegateEntry<__VA_ARGS__>;    \
+    extern template class Delegate<__VA_ARGS__>;          \
+    extern template class MultiDelegate<__VA_ARGS__>;
+
+#define DELEGATE_INSTANTIATE_TEMPLATE(...)                \
+    template class IDelegateEntry<__VA_ARGS__>;           \
+    template class Delegate<__VA_ARGS__>;                 \
+    template class MultiDelegate<__VA_ARGS__>;
+
+
 
 
 template<typename FuncSignature>
@@ -248,6 +266,29 @@ class DelegateEntryImplLambda<LambdaType, RetValType(ParamTypes...), PayloadType
 
 
 
+template<typename LinkType>
+void EraseDelegateLink(std::vector<LinkType*>& links, const LinkType* link) noexcept
+{
+    auto linkIt = std::find(links.begin(), links.end(), link);
+    if(linkIt != links.end())
+        links.erase(linkIt);
+}
+
+template<typename LinkType>
+void ReplaceDelegateLink(std::vector<LinkType*>& links, const LinkType* oldLink, LinkType* newLink) noexcept
+{
+    std::replace(links.begin(), links.end(), const_cast<LinkType*>(oldLink), newLink);
+}
+
+
+
+
+
+
+
+
+
+
 template<typename FuncSignature>
 class Delegate;
 
@@ -276,16 +317,50 @@ class Delegate<RetValType(ParamTypes...)>
         *this = std::move(other);
     }
 
+    ~Delegate() noexcept
+    {
+        Unbind();
+        RemoveForwardedFrom();
+    }
+
     Delegate& operator=(const Delegate& other) = delete;
     Delegate& operator=(Delegate&& other) noexcept
     {
+        if(this == &other)
+            return *this;
+
+        // Cutting both directions first also drops any link between this and other
+        Unbind();
+        RemoveForwardedFrom();
+
         Entry = other.Entry;
+        ForwardTarget = other.ForwardTarget;
         other.Entry = nullptr;
+        other.ForwardTarget = nullptr;
+
+        if(ForwardTarget)
+            ReplaceDelegateLink(ForwardTarget->ForwardedFrom, &other, this);
+
+        for(Delegate* source : other.ForwardedFrom)
+            source->ForwardTarget = this;
+
+        ForwardedFrom = std::move(other.ForwardedFrom);
+        other.ForwardedFrom.clear();
+
         return *this;
     }
 
 
-    NODISCARD bool IsBound() const noexcept { return Entry; }
+    NODISCARD bool IsBound() const noexcept { return ResolveForward()->Entry; }
+
+    NODISCARD bool IsForwardingTo(const Delegate& target) const noexcept
+    {
+        for(const Delegate* current = this; current; current = current->ForwardTarget)
+            if(current == &target)
+                return true;
+
+        return false;
+    }
 
 
     template<typename ObjectType>
@@ -293,7 +368,7 @@ class Delegate<RetValType(ParamTypes...)>
     {
         DELEGATE_ASSERT(object != nullptr);
 
-        delete Entry;
+        Unbind();
         Entry = new DelegateEntryImpl<ObjectType, RetValType(ParamTypes...)>(object, fn);
     }
 
@@ -302,7 +377,7 @@ class Delegate<RetValType(ParamTypes...)>
     {
         DELEGATE_ASSERT(object != nullptr);
 
-        delete Entry;
+        Unbind();
         Entry = new DelegateEntryImpl<ObjectType, RetValType(ParamTypes...), PayloadTypes...>(object, fn, payloads...);
     }
 
@@ -312,7 +387,7 @@ class Delegate<RetValType(ParamTypes...)>
     {
         DELEGATE_ASSERT(object != nullptr);
 
-        delete Entry;
+        Unbind();
         Entry = new DelegateEntryImplConst<ObjectType, RetValType(ParamTypes...)>(object, fn);
     }
 
@@ -321,7 +396,7 @@ class Delegate<RetValType(ParamTypes...)>
     {
         DELEGATE_ASSERT(object != nullptr);
 
-        delete Entry;
+        Unbind();
         Entry = new DelegateEntryImplConst<ObjectType, RetValType(ParamTypes...), PayloadTypes...>(object, fn, payloads...);
     }
 
@@ -329,28 +404,51 @@ class Delegate<RetValType(ParamTypes...)>
     template<typename LambdaType>
     void BindLambda(const LambdaType& fn)
     {
-        delete Entry;
+        Unbind();
         Entry = new DelegateEntryImplLambda<LambdaType, RetValType(ParamTypes...)>(fn);
     }
 
     template<typename LambdaType, typename... PayloadTypes>
     void BindLambda(const LambdaType& fn, PayloadTypes... payloads)
     {
-        delete Entry;
+        Unbind();
         Entry = new DelegateEntryImplLambda<LambdaType, RetValType(ParamTypes...), PayloadTypes...>(fn, payloads...);
     }
 
 
+    // Executing this delegate executes target instead, walking the whole chain without going through an extra entry.
+    // Returns false (and asserts) if target already forwards to this delegate, since that would create a cycle.
+    // Move assigning into a delegate cuts all of its existing forward links, then it takes over the links of the moved from delegate.
+    bool Forward(Delegate& target)
+    {
+        const bool createsCycle = target.IsForwardingTo(*this);
+        DELEGATE_ASSERT(!createsCycle);
+        if(createsCycle)
+            return false;
+
+        Unbind();
+        ForwardTarget = &target;
+        target.ForwardedFrom.push_back(this);
+        return true;
+    }
+
+
     void Unbind() noexcept
     {
         delete Entry;
         Entry = nullptr;
+
+        if(ForwardTarget)
+        {
+            EraseDelegateLink(ForwardTarget->ForwardedFrom, this);
+            ForwardTarget = nullptr;
+        }
     }
 
 
     RetValType Execute(ParamTypes... params) noexcept
     {
-        return Entry->Execute(params...);
+        return ResolveForward()->Entry->Execute(params...);
     }
 
     bool ExecuteIfBound(ParamTypes... params) noexcept
@@ -364,7 +462,37 @@ class Delegate<RetValType(ParamTypes...)>
 
 
 private:
+    void RemoveForwardedFrom() noexcept
+    {
+        for(Delegate* source : ForwardedFrom)
+            source->ForwardTarget = nullptr;
+
+        ForwardedFrom.clear();
+    }
+
+    NODISCARD const Delegate* ResolveForward() const noexcept
+    {
+        const Delegate* current = this;
+        while(current->ForwardTarget)
+            current = current->ForwardTarget;
+
+        return current;
+    }
+
+    NODISCARD Delegate* ResolveForward() noexcept
+    {
+        Delegate* current = this;
+        while(current->ForwardTarget)
+            current = current->ForwardTarget;
+
+        return current;
+    }
+
+
     IDelegateEntry<RetValType(ParamTypes...)>* Entry = nullptr;
+
+    Delegate* ForwardTarget = nullptr;
+    std::vector<Delegate*> ForwardedFrom;
 };
 
 
@@ -422,22 +550,79 @@ class MultiDelegate<RetValType(ParamTypes...)>
     MultiDelegate(const MultiDelegate& other) = delete;
     MultiDelegate(MultiDelegate&& other) noexcept
     {
-        *this == std::move(other);
+        *this = std::move(other);
+    }
+
+    ~MultiDelegate() noexcept
+    {
+        Clear();
+        RemoveAllForwards();
     }
 
     MultiDelegate& operator=(const MultiDelegate& other) = delete;
     MultiDelegate& operator=(MultiDelegate&& other) noexcept
     {
+        if(this == &other)
+            return *this;
+
+        // Cutting both directions first also drops any link between this and other
+        Clear();
+        RemoveAllForwards();
+
         CurrentID = other.CurrentID;
-        Entries = other.Entries;
+        Entries = std::move(other.Entries);
+        Forwards = std::move(other.Forwards);
+        ForwardedFrom = std::move(other.ForwardedFrom);
         other.CurrentID = 0;
         other.Entries.clear();
+        other.Forwards.clear();
+        other.ForwardedFrom.clear();
+
+        for(MultiDelegate* target : Forwards)
+            ReplaceDelegateLink(target->ForwardedFrom, &other, this);
+
+        for(MultiDelegate* source : ForwardedFrom)
+            ReplaceDelegateLink(source->Forwards, &other, this);
 
         return *this;
     }
 
 
-    NODISCARD bool HasAnyListeners() const noexcept { return Entries.size(); }
+    NODISCARD bool HasAnyListeners() const noexcept
+    {
+        if(Entries.size())
+            return true;
+
+        for(const MultiDelegate* target : Forwards)
+            if(target->HasAnyListeners())
+                return true;
+
+        return false;
+    }
+
+    NODISCARD bool IsForwardingTo(const MultiDelegate& target) const
+    {
+        // Chains can share delegates (diamonds), so every delegate is only visited once
+        std::vector<const MultiDelegate*> visited;
+        std::vector<const MultiDelegate*> pending{ this };
+
+        while(!pending.empty())
+        {
+            const MultiDelegate* current = pending.back();
+            pending.pop_back();
+
+            if(current == &target)
+                return true;
+
+            if(std::find(visited.begin(), visited.end(), current) != visited.end())
+                continue;
+
+            visited.push_back(current);
+            pending.insert(pending.end(), current->Forwards.begin(), current->Forwards.end());
+        }
+
+        return false;
+    }
 
     NODISCARD bool IsBound(const DelegateKey inKey) const noexcept
     {
@@ -520,10 +705,48 @@ class MultiDelegate<RetValType(ParamTypes...)>
     }
 
 
+    // Broadcasting this delegate also broadcasts target, after this delegate's own listeners.
+    // Forwarded delegates are walked directly and share the arguments instead of going through an extra entry.
+    // Returns false (and asserts) if target already forwards to this delegate, since that would create a cycle.
+    // Returns false if this delegate already forwards directly to target, so target's listeners never run twice for that link.
+    // Move assigning into a delegate cuts all of its existing forward links, then it takes over the links of the moved from delegate.
+    bool Forward(MultiDelegate& target)
+    {
+        if(std::find(Forwards.begin(), Forwards.end(), &target) != Forwards.end())
+            return false;
+
+        const bool createsCycle = target.IsForwardingTo(*this);
+        DELEGATE_ASSERT(!createsCycle);
+        if(createsCycle)
+            return false;
+
+        Forwards.push_back(&target);
+        target.ForwardedFrom.push_back(this);
+        return true;
+    }
+
+    void RemoveForward(MultiDelegate& target) noexcept
+    {
+        EraseDelegateLink(Forwards, &target);
+        EraseDelegateLink(target.ForwardedFrom, this);
+    }
+
+    void RemoveAllForwards() noexcept
+    {
+        for(MultiDelegate* target : Forwards)
+            EraseDelegateLink(target->ForwardedFrom, this);
+
+        for(MultiDelegate* source : ForwardedFrom)
+            EraseDelegateLink(source->Forwards, this);
+
+        Forwards.clear();
+        ForwardedFrom.clear();
+    }
+
+
     void Broadcast(ParamTypes... params) noexcept
     {
-        for(const EntryWrapper<RetValType, ParamTypes...>& entry : Entries)
-            entry.Entry->Execute(params...);
+        BroadcastChain(params...);
     }
 
     template<typename T = RetValType, std::enable_if_t<!std::is_void_v<T>>* = nullptr>
@@ -532,7 +755,280 @@ class MultiDelegate<RetValType(ParamTypes...)>
         std::vector<RetValType> temp;
         temp.reserve(Entries.size());
 
+        BroadcastRetValChain(temp, params...);
+        return temp;
+    }
+
+
+private:
+    NODISCARD DelegateKey GetNewID() noexcept { return CurrentID++; }
+
+    void BroadcastChain(std::add_lvalue_reference_t<ParamTypes>... params) noexcept
+    {
+        for(const EntryWrapper<RetValType, ParamTypes...>& entry : Entries)
+            entry.Entry->Execute(params...);
+
+        for(MultiDelegate* target : Forwards)
+            target->BroadcastChain(params...);
+    }
+
+    template<typename T = RetValType, std::enable_if_t<!std::is_void_v<T>>* = nullptr>
+    void BroadcastRetValChain(std::vector<RetValType>& outValues, std::add_lvalue_reference_t<ParamTypes>... params) noexcept
+    {
         for(const EntryWrapper<RetValType, ParamTypes...>& entry : Entries)
+            outValues.push_back(entry.Entry->Execute(params...));
+
+        for(MultiDelegate* target : Forwards)
+            target->BroadcastRetValChain(outValues, params...);
+    }
+
+
+    DelegateKey CurrentID = 0;
+    std::vector<EntryWrapper<RetValType, ParamTypes...>> Entries;
+
+    std::vector<MultiDelegate*> Forwards;
+    std::vector<MultiDelegate*> ForwardedFrom;
+};
+
+
+
+
+
+
+
+
+
+
+template<typename FilterKeyType, typename FuncSignature>
+class KeyedMultiDelegate;
+
+// MultiDelegate variant where every listener is filed under a filter key.
+// Broadcast(key, ...) only executes listeners added for that key plus wildcard listeners,
+// so cost scales with the number of matching listeners instead of all listeners.
+// Removing a listener swaps the last listener of its list into its place, so execution order within a key is not preserved.
+template<typename FilterKeyType, typename RetValType, typename... ParamTypes>
+class KeyedMultiDelegate<FilterKeyType, RetValType(ParamTypes...)>
+{
+    template<typename ObjectType>
+    using FuncType = RetValType(ObjectType::*)(ParamTypes...);
+
+    template<typename ObjectType>
+    using ConstFuncType = RetValType(ObjectType::*)(ParamTypes...) const;
+
+
+    template<typename ObjectType, typename... PayloadTypes>
+    using FuncTypePayload = RetValType(ObjectType::*)(ParamTypes..., PayloadTypes...);
+
+    template<typename ObjectType, typename... PayloadTypes>
+    using ConstFuncTypePayload = RetValType(ObjectType::*)(ParamTypes..., PayloadTypes...) const;
+
+
+    using ListenerList = std::vector<EntryWrapper<RetValType, ParamTypes...>>;
+
+    // Key is nullptr for wildcard listeners, otherwise it points at the key stored inside KeyedEntries
+    struct EntryLocation
+    {
+        const FilterKeyType* Key;
+        size_t Index;
+    };
+
+
+public:
+    KeyedMultiDelegate() noexcept = default;
+    KeyedMultiDelegate(const KeyedMultiDelegate& other) = delete;
+    KeyedMultiDelegate(KeyedMultiDelegate&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    ~KeyedMultiDelegate() noexcept
+    {
+        Clear();
+    }
+
+    KeyedMultiDelegate& operator=(const KeyedMultiDelegate& other) = delete;
+    KeyedMultiDelegate& operator=(KeyedMultiDelegate&& other) noexcept
+    {
+        if(this == &other)
+            return *this;
+
+        Clear();
+
+        CurrentID = other.CurrentID;
+        KeyedEntries = std::move(other.KeyedEntries);
+        WildcardEntries = std::move(other.WildcardEntries);
+        Locations = std::move(other.Locations);
+
+        other.CurrentID = 0;
+        other.KeyedEntries.clear();
+        other.WildcardEntries.clear();
+        other.Locations.clear();
+
+        return *this;
+    }
+
+
+    NODISCARD bool HasAnyListeners() const noexcept { return Locations.size(); }
+
+    NODISCARD bool HasAnyListeners(const FilterKeyType& filterKey) const noexcept
+    {
+        return WildcardEntries.size() || KeyedEntries.contains(filterKey);
+    }
+
+    NODISCARD bool IsBound(const DelegateKey inKey) const noexcept { return Locations.contains(inKey); }
+
+
+    template<typename ObjectType>
+    DelegateKey AddObject(const FilterKeyType& filterKey, ObjectType* object, const FuncType<ObjectType>& fn)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddKeyedEntry(filterKey, new DelegateEntryImpl<ObjectType, RetValType(ParamTypes...)>(object, fn));
+    }
+
+    template<typename ObjectType, typename... PayloadTypes>
+    DelegateKey AddObject(const FilterKeyType& filterKey, ObjectType* object, const FuncTypePayload<ObjectType, PayloadTypes...>& fn, PayloadTypes... payloads)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddKeyedEntry(filterKey, new DelegateEntryImpl<ObjectType, RetValType(ParamTypes...), PayloadTypes...>(object, fn, payloads...));
+    }
+
+
+    template<typename ObjectType>
+    DelegateKey AddObject(const FilterKeyType& filterKey, ObjectType* object, const ConstFuncType<ObjectType>& fn)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddKeyedEntry(filterKey, new DelegateEntryImplConst<ObjectType, RetValType(ParamTypes...)>(object, fn));
+    }
+
+    template<typename ObjectType, typename... PayloadTypes>
+    DelegateKey AddObject(const FilterKeyType& filterKey, ObjectType* object, const ConstFuncTypePayload<ObjectType, PayloadTypes...>& fn, PayloadTypes... payloads)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddKeyedEntry(filterKey, new DelegateEntryImplConst<ObjectType, RetValType(ParamTypes...), PayloadTypes...>(object, fn, payloads...));
+    }
+
+
+    template<typename LambdaType>
+    DelegateKey AddLambda(const FilterKeyType& filterKey, const LambdaType& fn)
+    {
+        return AddKeyedEntry(filterKey, new DelegateEntryImplLambda<LambdaType, RetValType(ParamTypes...)>(fn));
+    }
+
+    template<typename LambdaType, typename... PayloadTypes>
+    DelegateKey AddLambda(const FilterKeyType& filterKey, const LambdaType& fn, PayloadTypes... payloads)
+    {
+        return AddKeyedEntry(filterKey, new DelegateEntryImplLambda<LambdaType, RetValType(ParamTypes...), PayloadTypes...>(fn, payloads...));
+    }
+
+
+    template<typename ObjectType>
+    DelegateKey AddWildcardObject(ObjectType* object, const FuncType<ObjectType>& fn)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddWildcardEntry(new DelegateEntryImpl<ObjectType, RetValType(ParamTypes...)>(object, fn));
+    }
+
+    template<typename ObjectType, typename... PayloadTypes>
+    DelegateKey AddWildcardObject(ObjectType* object, const FuncTypePayload<ObjectType, PayloadTypes...>& fn, PayloadTypes... payloads)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddWildcardEntry(new DelegateEntryImpl<ObjectType, RetValType(ParamTypes...), PayloadTypes...>(object, fn, payloads...));
+    }
+
+
+    template<typename ObjectType>
+    DelegateKey AddWildcardObject(ObjectType* object, const ConstFuncType<ObjectType>& fn)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddWildcardEntry(new DelegateEntryImplConst<ObjectType, RetValType(ParamTypes...)>(object, fn));
+    }
+
+    template<typename ObjectType, typename... PayloadTypes>
+    DelegateKey AddWildcardObject(ObjectType* object, const ConstFuncTypePayload<ObjectType, PayloadTypes...>& fn, PayloadTypes... payloads)
+    {
+        DELEGATE_ASSERT(object != nullptr);
+        return AddWildcardEntry(new DelegateEntryImplConst<ObjectType, RetValType(ParamTypes...), PayloadTypes...>(object, fn, payloads...));
+    }
+
+
+    template<typename LambdaType>
+    DelegateKey AddWildcardLambda(const LambdaType& fn)
+    {
+        return AddWildcardEntry(new DelegateEntryImplLambda<LambdaType, RetValType(ParamTypes...)>(fn));
+    }
+
+    template<typename LambdaType, typename... PayloadTypes>
+    DelegateKey AddWildcardLambda(const LambdaType& fn, PayloadTypes... payloads)
+    {
+        return AddWildcardEntry(new DelegateEntryImplLambda<LambdaType, RetValType(ParamTypes...), PayloadTypes...>(fn, payloads...));
+    }
+
+
+    void Remove(const DelegateKey inKey) noexcept
+    {
+        auto locationIt = Locations.find(inKey);
+        if(locationIt == Locations.end())
+            return;
+
+        const EntryLocation location = locationIt->second;
+        Locations.erase(locationIt);
+
+        auto listIt = location.Key ? KeyedEntries.find(*location.Key) : KeyedEntries.end();
+        ListenerList& list = location.Key ? listIt->second : WildcardEntries;
+        delete list[location.Index].Entry;
+
+        if(location.Index != list.size() - 1)
+        {
+            list[location.Index] = list.back();
+            Locations.find(list[location.Index].ID)->second.Index = location.Index;
+        }
+
+        list.pop_back();
+
+        if(location.Key && list.empty())
+            KeyedEntries.erase(listIt);
+    }
+
+    void Clear() noexcept
+    {
+        for(const auto& [filterKey, list] : KeyedEntries)
+            for(const EntryWrapper<RetValType, ParamTypes...>& entry : list)
+                delete entry.Entry;
+
+        for(const EntryWrapper<RetValType, ParamTypes...>& entry : WildcardEntries)
+            delete entry.Entry;
+
+        KeyedEntries.clear();
+        WildcardEntries.clear();
+        Locations.clear();
+    }
+
+
+    void Broadcast(const FilterKeyType& filterKey, ParamTypes... params) noexcept
+    {
+        auto listIt = KeyedEntries.find(filterKey);
+        if(listIt != KeyedEntries.end())
+            for(const EntryWrapper<RetValType, ParamTypes...>& entry : listIt->second)
+                entry.Entry->Execute(params...);
+
+        for(const EntryWrapper<RetValType, ParamTypes...>& entry : WildcardEntries)
+            entry.Entry->Execute(params...);
+    }
+
+    template<typename T = RetValType, std::enable_if_t<!std::is_void_v<T>>* = nullptr>
+    std::vector<RetValType> BroadcastRetVal(const FilterKeyType& filterKey, ParamTypes... params) noexcept
+    {
+        auto listIt = KeyedEntries.find(filterKey);
+        const size_t keyedCount = listIt != KeyedEntries.end() ? listIt->second.size() : 0;
+
+        std::vector<RetValType> temp;
+        temp.reserve(keyedCount + WildcardEntries.size());
+
+        if(keyedCount)
+            for(const EntryWrapper<RetValType, ParamTypes...>& entry : listIt->second)
+                temp.push_back(entry.Entry->Execute(params...));
+
+        for(const EntryWrapper<RetValType, ParamTypes...>& entry : WildcardEntries)
             temp.push_back(entry.Entry->Execute(params...));
 
         return temp;
@@ -542,8 +1038,28 @@ class MultiDelegate<RetValType(ParamTypes...)>
 private:
     NODISCARD DelegateKey GetNewID() noexcept { return CurrentID++; }
 
+    DelegateKey AddKeyedEntry(const FilterKeyType& filterKey, IDelegateEntry<RetValType(ParamTypes...)>* entry)
+    {
+        auto listIt = KeyedEntries.try_emplace(filterKey).first;
+        ListenerList& list = listIt->second;
+
+        list.emplace_back(GetNewID(), entry);
+        Locations.emplace(list.back().ID, EntryLocation{ &listIt->first, list.size() - 1 });
+        return list.back().ID;
+    }
+
+    DelegateKey AddWildcardEntry(IDelegateEntry<RetValType(ParamTypes...)>* entry)
+    {
+        WildcardEntries.emplace_back(GetNewID(), entry);
+        Locations.emplace(WildcardEntries.back().ID, EntryLocation{ nullptr, WildcardEntries.size() - 1 });
+        return WildcardEntries.back().ID;
+    }
+
+
     DelegateKey CurrentID = 0;
-    std::vector<EntryWrapper<RetValType, ParamTypes...>> Entries;
+    std::unordered_map<FilterKeyType, ListenerList> KeyedEntries;
+    ListenerList WildcardEntries;
+    std::unordered_map<DelegateKey, EntryLocation> Locations;
 };
 
 
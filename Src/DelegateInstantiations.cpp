@@ -0,0 +1,7 @@
+#include "Delegate.h"
+
+
+// Instantiated once here, every other translation unit sees them as extern through TestClass.h
+DELEGATE_INSTANTIATE_TEMPLATE(void(int))
+DELEGATE_INSTANTIATE_TEMPLATE(void(const char*))
+DELEGATE_INSTANTIATE_TEMPLATE(float())
@@ -0,0 +1,411 @@
+#pragma once
+
+
+#include "Delegate.h"
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+#include <type_traits>
+#include <array>
+#include <bit>
+#include <utility>
+
+
+
+
+#if defined(DELEGATE_NO_NODISCARD)
+    #define NODISCARD
+#else
+    #define NODISCARD [[nodiscard]]
+#endif
+
+
+
+
+// A recording file starts with this header, DelegateReplayer refuses files with a different magic or version
+struct DelegateRecordFileHeader
+{
+    char Magic[4];
+    uint32_t Version;
+};
+
+constexpr DelegateRecordFileHeader DelegateRecordCurrentFileHeader = { { 'D', 'L', 'G', 'R' }, 1 };
+
+
+// Every record in a recording file is this header followed by PayloadSize bytes of tightly packed arguments
+struct DelegateRecordHeader
+{
+    uint32_t DelegateID;
+    uint32_t PayloadSize;
+    uint64_t Timestamp;
+};
+
+
+template<typename... ParamTypes>
+constexpr uint32_t DelegateRecordPayloadSize = (0 + ... + static_cast<uint32_t>(sizeof(std::decay_t<ParamTypes>)));
+
+template<typename... ParamTypes>
+constexpr size_t DelegateRecordPayloadOffset(const size_t index)
+{
+    const size_t sizes[] = { sizeof(std::decay_t<ParamTypes>)..., 0 };
+
+    size_t offset = 0;
+    for(size_t i = 0; i < index; i++)
+        offset += sizes[i];
+
+    return offset;
+}
+
+// Parameters are recorded by value, so non-const references (out parameters) can't be replayed
+template<typename ParamType>
+constexpr bool IsRecordableParam = std::is_trivially_copyable_v<std::decay_t<ParamType>>
+    && (!std::is_reference_v<ParamType> || (std::is_lvalue_reference_v<ParamType> && std::is_const_v<std::remove_reference_t<ParamType>>));
+
+template<typename... ParamTypes>
+constexpr bool IsRecordableSignature = (true && ... && IsRecordableParam<ParamTypes>);
+
+
+
+
+// Appends every broadcast of the attached MultiDelegates to a binary file.
+// Only void returning signatures with trivially copyable parameters can be recorded.
+// Pointers are stored as raw addresses, so they are only meaningful if the replaying side knows how to treat them.
+class DelegateRecorder
+{
+    using DestroyFuncType = void(*)(void* tap);
+
+    // Attached delegates forward into a MultiDelegate owned by the recorder, so the forward links follow the attached
+    // delegate when it is moved and are cut when either the attached delegate or the recorder is destroyed
+    struct Attachment
+    {
+        DelegateKey Key;
+        void* Tap = nullptr;
+        DestroyFuncType Function = nullptr;
+    };
+
+
+public:
+    DelegateRecorder() = delete;
+    DelegateRecorder(const DelegateRecorder& other) = delete;
+    DelegateRecorder& operator=(const DelegateRecorder& other) = delete;
+
+    explicit DelegateRecorder(const char* filePath, const size_t bufferSize = 64 * 1024)
+        : File(std::fopen(filePath, "wb")), StartTime(std::chrono::steady_clock::now())
+    {
+        Buffer.reserve(bufferSize);
+
+        if(File)
+        {
+            Buffer.resize(sizeof(DelegateRecordFileHeader));
+            std::memcpy(Buffer.data(), &DelegateRecordCurrentFileHeader, sizeof(DelegateRecordFileHeader));
+        }
+    }
+
+    ~DelegateRecorder() noexcept
+    {
+        for(const Attachment& attachment : Attachments)
+            attachment.Function(attachment.Tap);
+
+        if(!File)
+            return;
+
+        Flush();
+        std::fclose(File);
+    }
+
+
+    NODISCARD bool IsOpen() const noexcept { return File; }
+
+    // True once any write to the file has failed, records that failed to be written are lost
+    NODISCARD bool HasWriteFailed() const noexcept { return WriteFailed; }
+
+
+    template<typename... ParamTypes>
+    DelegateKey Attach(const uint32_t delegateID, MultiDelegate<void(ParamTypes...)>& delegate)
+    {
+        static_assert(IsRecordableSignature<ParamTypes...>, "Only trivially copyable parameters taken by value or const reference can be recorded!");
+
+        MultiDelegate<void(ParamTypes...)>* tap = new MultiDelegate<void(ParamTypes...)>();
+        tap->AddLambda([this, delegateID] (ParamTypes... params) { Record<ParamTypes...>(delegateID, params...); });
+        delegate.Forward(*tap);
+
+        Attachments.push_back(Attachment{ CurrentID, tap, &DestroyTap<ParamTypes...> });
+        return CurrentID++;
+    }
+
+    // Keys are the ones returned by Attach, not keys of the attached delegate. Unknown keys are ignored.
+    void Detach(const DelegateKey inKey) noexcept
+    {
+        auto attachmentIt = std::find_if(Attachments.begin(), Attachments.end(), [inKey] (const Attachment& attachment)
+        {
+            return attachment.Key == inKey;
+        });
+
+        if(attachmentIt == Attachments.end())
+            return;
+
+        attachmentIt->Function(attachmentIt->Tap);
+        Attachments.erase(attachmentIt);
+    }
+
+
+    template<typename... ParamTypes>
+    void Record(const uint32_t delegateID, const ParamTypes&... params) noexcept
+    {
+        static_assert(IsRecordableSignature<ParamTypes...>, "Only trivially copyable parameters taken by value or const reference can be recorded!");
+
+        if(!File)
+            return;
+
+        constexpr uint32_t payloadSize = DelegateRecordPayloadSize<ParamTypes...>;
+        constexpr size_t recordSize = sizeof(DelegateRecordHeader) + payloadSize;
+
+        if(Buffer.size() + recordSize > Buffer.capacity())
+            Flush();
+
+        const DelegateRecordHeader header
+        {
+            delegateID,
+            payloadSize,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime).count())
+        };
+
+        const size_t offset = Buffer.size();
+        Buffer.resize(offset + recordSize);
+
+        char* cursor = Buffer.data() + offset;
+        std::memcpy(cursor, &header, sizeof(header));
+        cursor += sizeof(header);
+
+        ((std::memcpy(cursor, &params, sizeof(std::decay_t<ParamTypes>)), cursor += sizeof(std::decay_t<ParamTypes>)), ...);
+    }
+
+    // Returns false if the buffered records couldn't be written completely
+    bool Flush() noexcept
+    {
+        if(!File || Buffer.empty())
+            return File;
+
+        const bool written = std::fwrite(Buffer.data(), 1, Buffer.size(), File) == Buffer.size() && std::fflush(File) == 0;
+        Buffer.clear();
+
+        WriteFailed |= !written;
+        return written;
+    }
+
+
+private:
+    template<typename... ParamTypes>
+    static void DestroyTap(void* tap) noexcept
+    {
+        delete static_cast<MultiDelegate<void(ParamTypes...)>*>(tap);
+    }
+
+
+    DelegateKey CurrentID = 0;
+    std::FILE* File = nullptr;
+    std::chrono::steady_clock::time_point StartTime;
+    std::vector<char> Buffer;
+    std::vector<Attachment> Attachments;
+    bool WriteFailed = false;
+};
+
+
+
+
+
+
+
+
+
+
+struct DelegateReplayStats
+{
+    size_t BroadcastCount = 0;
+    uint64_t TotalNanoseconds = 0;
+    uint64_t MaxNanoseconds = 0;
+};
+
+
+
+// Loads a file written by DelegateRecorder and re-issues the recorded broadcasts on bound MultiDelegates.
+// The file is read into memory once and arguments are unpacked straight out of that buffer.
+class DelegateReplayer
+{
+    using ReplayFuncType = void(*)(void* delegate, const char* payload);
+
+    struct ReplayChannel
+    {
+        void* Delegate = nullptr;
+        ReplayFuncType Function = nullptr;
+        uint32_t PayloadSize = 0;
+        DelegateReplayStats Stats;
+    };
+
+
+public:
+    DelegateReplayer() = delete;
+    DelegateReplayer(const DelegateReplayer& other) = delete;
+    DelegateReplayer& operator=(const DelegateReplayer& other) = delete;
+
+    explicit DelegateReplayer(const char* filePath, const size_t readChunkSize = 1024 * 1024)
+    {
+        DELEGATE_ASSERT(readChunkSize > 0);
+        const size_t chunkSize = std::max<size_t>(readChunkSize, 1);
+
+        std::FILE* file = std::fopen(filePath, "rb");
+        if(!file)
+            return;
+
+        // Read in chunks until EOF instead of asking for the file size, ftell is limited to 2GB on some platforms
+        size_t readSize = 0;
+        do
+        {
+            Data.resize(readSize + chunkSize);
+            readSize += std::fread(Data.data() + readSize, 1, chunkSize, file);
+        }
+        while(readSize == Data.size());
+
+        Data.resize(readSize);
+        Loaded = !std::ferror(file) && HasValidFileHeader();
+
+        std::fclose(file);
+
+        if(!Loaded)
+            Data.clear();
+    }
+
+
+    NODISCARD bool IsLoaded() const noexcept { return Loaded; }
+
+
+    template<typename... ParamTypes>
+    void Bind(const uint32_t delegateID, MultiDelegate<void(ParamTypes...)>& delegate)
+    {
+        static_assert(IsRecordableSignature<ParamTypes...>, "Only trivially copyable parameters taken by value or const reference can be replayed!");
+
+        ReplayChannel& channel = Channels[delegateID];
+        channel.Delegate = &delegate;
+        channel.Function = &ReplayBroadcast<ParamTypes...>;
+        channel.PayloadSize = DelegateRecordPayloadSize<ParamTypes...>;
+    }
+
+    void Unbind(const uint32_t delegateID) noexcept
+    {
+        Channels.erase(delegateID);
+    }
+
+
+    // Replays every record in the file. Records of unbound delegates are skipped.
+    // If realTime is true, the original spacing between broadcasts is kept, otherwise they are issued back to back.
+    // Returns false if nothing was loaded or the file ends with a truncated record, everything before it is still replayed.
+    bool Replay(const bool realTime = false)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        if(!Loaded)
+            return false;
+
+        size_t offset = sizeof(DelegateRecordFileHeader);
+        while(offset + sizeof(DelegateRecordHeader) <= Data.size())
+        {
+            DelegateRecordHeader header;
+            std::memcpy(&header, Data.data() + offset, sizeof(header));
+            offset += sizeof(header);
+
+            if(offset + header.PayloadSize > Data.size())
+                return false;
+
+            const char* payload = Data.data() + offset;
+            offset += header.PayloadSize;
+
+            auto channelIt = Channels.find(header.DelegateID);
+            if(channelIt == Channels.end())
+                continue;
+
+            ReplayChannel& channel = channelIt->second;
+            DELEGATE_ASSERT(channel.PayloadSize == header.PayloadSize);
+            if(channel.PayloadSize != header.PayloadSize)
+                continue;
+
+            if(realTime)
+                std::this_thread::sleep_until(startTime + std::chrono::nanoseconds(header.Timestamp));
+
+            const auto broadcastStart = std::chrono::steady_clock::now();
+            channel.Function(channel.Delegate, payload);
+            const uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - broadcastStart).count());
+
+            channel.Stats.BroadcastCount++;
+            channel.Stats.TotalNanoseconds += elapsed;
+            if(elapsed > channel.Stats.MaxNanoseconds)
+                channel.Stats.MaxNanoseconds = elapsed;
+        }
+
+        return offset == Data.size();
+    }
+
+
+    NODISCARD DelegateReplayStats GetStats(const uint32_t delegateID) const noexcept
+    {
+        auto channelIt = Channels.find(delegateID);
+        return channelIt != Channels.end() ? channelIt->second.Stats : DelegateReplayStats();
+    }
+
+    void ResetStats() noexcept
+    {
+        for(auto& [delegateID, channel] : Channels)
+            channel.Stats = DelegateReplayStats();
+    }
+
+
+private:
+    NODISCARD bool HasValidFileHeader() const noexcept
+    {
+        if(Data.size() < sizeof(DelegateRecordFileHeader))
+            return false;
+
+        DelegateRecordFileHeader fileHeader;
+        std::memcpy(&fileHeader, Data.data(), sizeof(fileHeader));
+
+        return std::memcmp(fileHeader.Magic, DelegateRecordCurrentFileHeader.Magic, sizeof(fileHeader.Magic)) == 0
+            && fileHeader.Version == DelegateRecordCurrentFileHeader.Version;
+    }
+
+    template<typename... ParamTypes>
+    static void ReplayBroadcast(void* delegate, const char* payload) noexcept
+    {
+        ReplayBroadcastImpl<ParamTypes...>(delegate, payload, std::index_sequence_for<ParamTypes...>());
+    }
+
+    template<typename... ParamTypes, size_t... Indices>
+    static void ReplayBroadcastImpl(void* delegate, const char* payload, std::index_sequence<Indices...>) noexcept
+    {
+        static_cast<MultiDelegate<void(ParamTypes...)>*>(delegate)->Broadcast(
+            ReadParam<std::decay_t<ParamTypes>>(payload + DelegateRecordPayloadOffset<ParamTypes...>(Indices))...);
+    }
+
+    // Goes through a byte array so parameter types don't need to be default constructible
+    template<typename T>
+    NODISCARD static T ReadParam(const char* source) noexcept
+    {
+        std::array<char, sizeof(T)> bytes;
+        std::memcpy(bytes.data(), source, sizeof(T));
+        return std::bit_cast<T>(bytes);
+    }
+
+
+    std::vector<char> Data;
+    std::unordered_map<uint32_t, ReplayChannel> Channels;
+    bool Loaded = false;
+};
+
+
+
+
+#undef NODISCARD
@@ -1,5 +1,6 @@
 
 #include "Delegate.h"
+#include "DelegateRecorder.h"
 #include "TestClass.h"
 
 
@@ -79,6 +80,84 @@ int main(int argc, char** argv)
     o->PrintSomeNumbers();
 
 
+    /////////////////////////////////////////////////////////////////////////////////////
+    std::cout << "\n----------------------\n\n";
+    /////////////////////////////////////////////////////////////////////////////////////
+
+
+    KeyedMultiDelegate<int, void(int)> keyedDel;
+    DelegateKey keyedKey = keyedDel.AddObject(1, o, &OtherTestClass::PrintInt);
+    keyedDel.AddLambda(2, [] (int damage) { std::cout << "Entity 2 took " << damage << '\n'; });
+    keyedDel.AddWildcardLambda([] (int damage) { std::cout << "Someone took " << damage << '\n'; });
+    keyedDel.Broadcast(1, 10);
+    keyedDel.Broadcast(2, 20);
+    keyedDel.Remove(keyedKey);
+    keyedDel.Broadcast(1, 30);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    std::cout << "\n----------------------\n\n";
+    /////////////////////////////////////////////////////////////////////////////////////
+
+
+    MultiDelegate<void(int, float)> recordedDel;
+    {
+        DelegateRecorder recorder("DelegateRecording.bin");
+        recorder.Attach(0, recordedDel);
+        recordedDel.Broadcast(1, 1.5f);
+        recordedDel.Broadcast(2, 2.5f);
+    }
+
+    recordedDel.AddLambda([] (int number, float otherNumber) { std::cout << "Replayed " << number << " - " << otherNumber << '\n'; });
+
+    DelegateReplayer replayer("DelegateRecording.bin");
+    replayer.Bind(0, recordedDel);
+    replayer.Replay();
+    std::cout << "Replayed broadcast count: " << replayer.GetStats(0).BroadcastCount << '\n';
+
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    std::cout << "\n----------------------\n\n";
+    /////////////////////////////////////////////////////////////////////////////////////
+
+
+    MultiDelegate<void(const char*)> forwardedDel;
+    forwardedDel.Forward(a->DestructorDelegate);
+    forwardedDel.AddLambda([] (const char* message) { std::cout << "Forwarding: " << message << '\n'; });
+    forwardedDel.Broadcast("Forwarded Message");
+
+    Delegate<void(int)> forwardedSingleDel;
+    forwardedSingleDel.Forward(a->AddDelegate);
+    forwardedSingleDel.ExecuteIfBound(42);
+
+    // Moving a delegate into its forward target drops that link instead of making the target forward to itself
+    Delegate<void(int)> movedToDel;
+    movedToDel.BindObject(o, &OtherTestClass::PrintInt);
+    Delegate<void(int)> movedFromDel;
+    movedFromDel.Forward(movedToDel);
+    movedToDel = std::move(movedFromDel);
+    std::cout << "Moved into forward target is bound: " << movedToDel.IsBound() << '\n';
+
+    // Self move keeps the binding
+    movedToDel.BindObject(o, &OtherTestClass::PrintInt);
+    Delegate<void(int)>& sameDel = movedToDel;
+    movedToDel = std::move(sameDel);
+    movedToDel.ExecuteIfBound(43);
+
+    MultiDelegate<const char*()> movedToMultiDel;
+    movedToMultiDel.AddLambda([] () { return "Moved To"; });
+    MultiDelegate<const char*()> movedFromMultiDel;
+    movedFromMultiDel.Forward(movedToMultiDel);
+    movedToMultiDel = std::move(movedFromMultiDel);
+    std::cout << "Moved into forward target has listeners: " << movedToMultiDel.HasAnyListeners() << '\n';
+
+    movedToMultiDel.AddLambda([] () { return "Self Moved"; });
+    MultiDelegate<const char*()>& sameMultiDel = movedToMultiDel;
+    movedToMultiDel = std::move(sameMultiDel);
+    for(const char* message : movedToMultiDel.BroadcastRetVal())
+        std::cout << message << '\n';
+
+
     /////////////////////////////////////////////////////////////////////////////////////
     std::cout << "\n----------------------\n\n";
     /////////////////////////////////////////////////////////////////////////////////////
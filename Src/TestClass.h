@@ -7,6 +7,12 @@
 
 
 
+DELEGATE_EXTERN_TEMPLATE(void(int))
+DELEGATE_EXTERN_TEMPLATE(void(const char*))
+DELEGATE_EXTERN_TEMPLATE(float())
+
+
+
 
 class TestClass
 {